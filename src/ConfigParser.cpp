@@ -0,0 +1,40 @@
+#include <Arduino.h>
+#include <map>
+
+class ConfigParser {
+public:
+    // Parses the two column CSV exported by the config sheet
+    // ("key","value" per line) into a key/value map
+    static std::map<String, String> parse(const String& payload) {
+        std::map<String, String> data;
+        int startPos = 0;
+        int endPos = payload.indexOf('\n');
+        bool isLastItem = false;
+        while (endPos != -1) {
+            Serial.println("---------------");
+
+            String line = payload.substring(startPos, endPos);
+
+            int commaPos = line.indexOf(',');
+            if (commaPos != -1) {
+                String key = line.substring(1, commaPos - 1);
+                key.replace("\"", "");
+                String value = line.substring(commaPos + 2, line.length() - 1);
+                value.replace("\"", "");
+
+                data[key] = value;
+            }
+            startPos = endPos + 1;
+            endPos = payload.indexOf('\n', startPos);
+            if (isLastItem) {
+                break;
+            }
+
+            if (endPos == -1) {
+                endPos = payload.length();
+                isLastItem = true;
+            }
+        }
+        return data;
+    }
+};
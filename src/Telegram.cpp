@@ -0,0 +1,50 @@
+#include <Arduino.h>
+
+class Telegram {
+public:
+    static String reading(float temperature, float humidity, float score,
+                          float acOnScore, float acOffScore) {
+        return "\n☀️ Temperature: " + String(temperature) +
+               "C,\n💧 Humidity: " + String(humidity) +
+               ",\n\n📋 currentScore: " + String(score) +
+               ",\n\n🔛 AC ON @: " + String(acOnScore) +
+               ",\n📴 AC OFF @: " + String(acOffScore);
+    }
+
+    static String sendMessageUrl(const char* apiKey, const char* groupId,
+                                 const String& msg) {
+        return "https://api.telegram.org/" + String(apiKey) +
+               "/sendMessage?chat_id=-" + String(groupId) +
+               "&text=" + urlencode(msg);
+    }
+
+    static String urlencode(String str) {
+        String encodedString = "";
+        char c;
+        char code0;
+        char code1;
+        for (unsigned int i = 0; i < str.length(); i++) {
+            c = str.charAt(i);
+            if (c == ' ') {
+                encodedString += '+';
+            } else if (isalnum(c)) {
+                encodedString += c;
+            } else {
+                code1 = (c & 0xf) + '0';
+                if ((c & 0xf) > 9) {
+                    code1 = (c & 0xf) - 10 + 'A';
+                }
+                c = (c >> 4) & 0xf;
+                code0 = c + '0';
+                if (c > 9) {
+                    code0 = c - 10 + 'A';
+                }
+                encodedString += '%';
+                encodedString += code0;
+                encodedString += code1;
+            }
+            yield();
+        }
+        return encodedString;
+    }
+};
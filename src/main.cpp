@@ -7,7 +7,10 @@
 #include <WiFiClientSecureBearSSL.h>
 #include <WiFiUDP.h>
 
+#include <ConfigParser.cpp>
 #include <NetworkClient.cpp>
+#include <ScoreCalculator.cpp>
+#include <Telegram.cpp>
 #include <WiFi.cpp>
 #include <map>
 
@@ -44,37 +47,7 @@ std::map<String, String> fetchConfig() {
         int responseCode = formRequest.GET();
         if (responseCode > 0) {
             String payload = formRequest.getString();
-            // Parse the payload and populate the data map
-
-            int startPos = 0;
-            int endPos = payload.indexOf('\n');
-            bool isLastItem = false;
-            while (endPos != -1) {
-                Serial.println("---------------");
-
-                String line = payload.substring(startPos, endPos);
-
-                int commaPos = line.indexOf(',');
-                if (commaPos != -1) {
-                    String key = line.substring(1, commaPos - 1);
-                    key.replace("\"", "");
-                    String value =
-                        line.substring(commaPos + 2, line.length() - 1);
-                    value.replace("\"", "");
-
-                    data[key] = value;
-                }
-                startPos = endPos + 1;
-                endPos = payload.indexOf('\n', startPos);
-                if (isLastItem) {
-                    break;
-                }
-
-                if (endPos == -1) {
-                    endPos = payload.length();
-                    isLastItem = true;
-                }
-            }
+            data = ConfigParser::parse(payload);
         }
     }
 
@@ -243,12 +216,9 @@ void loop() {
                                    " or above");
                     Serial.println("AC off score: " + String(acOffScore) +
                                    " or below");
-                    telegramLog +=
-                        "\n☀️ Temperature: " + String(temperature) +
-                        "C,\n💧 Humidity: " + String(humidity) +
-                        ",\n\n📋 currentScore: " + String(currentScore) +
-                        ",\n\n🔛 AC ON @: " + String(acOnScore) +
-                        ",\n📴 AC OFF @: " + String(acOffScore);
+                    telegramLog += Telegram::reading(temperature, humidity,
+                                                     currentScore, acOnScore,
+                                                     acOffScore);
 
                     if (currentScore > acOnScore) {
                         if (isOnOff) {
@@ -388,97 +358,8 @@ void loop() {
 }
 
 
-// Helper function to calculate Heat Index (simplified version for indoor use)
-float calculateHeatIndex(float tempC, float humidity) {
-    // For temperatures below 26°C, heat index has minimal effect
-    if (tempC < 26.0) {
-        return tempC + (humidity > 70.0 ? (humidity - 70.0) * 0.02 : 0);
-    }
-    
-    // Convert to Fahrenheit for calculation
-    float tempF = (tempC * 9.0 / 5.0) + 32.0;
-    
-    // Simplified heat index formula (Steadman's approximation)
-    float heatIndexF = 0.5 * (tempF + 61.0 + ((tempF - 68.0) * 1.2) + (humidity * 0.094));
-    
-    // For higher temperatures, use more accurate formula
-    if (heatIndexF > 80.0) {
-        float T = tempF;
-        float RH = humidity;
-        
-        heatIndexF = -42.379 + 
-                    2.04901523 * T + 
-                    10.14333127 * RH + 
-                    -0.22475541 * T * RH + 
-                    -0.00683783 * T * T + 
-                    -0.05481717 * RH * RH + 
-                    0.00122874 * T * T * RH + 
-                    0.00085282 * T * RH * RH + 
-                    -0.00000199 * T * T * RH * RH;
-        
-        // Adjustments for specific conditions
-        if (RH < 13.0 && T >= 80.0 && T <= 112.0) {
-            heatIndexF -= ((13.0 - RH) / 4.0) * sqrt((17.0 - abs(T - 95.0)) / 17.0);
-        }
-        if (RH > 85.0 && T >= 80.0 && T <= 87.0) {
-            heatIndexF += ((RH - 85.0) / 10.0) * ((87.0 - T) / 5.0);
-        }
-    }
-    
-    // Convert back to Celsius
-    return (heatIndexF - 32.0) * 5.0 / 9.0;
-}
-
 float calculateScore(float temperature, float humidity) {
-    // Get config values
-    float comfortTemperature = config["comfort_temperature"].toFloat();
-    float comfortHumidity = config["comfort_humidity"].toFloat();
-    float tempWeight = config["temperature_weight"].toFloat();
-    float humidityWeight = config["humidity_weight"].toFloat();
-    float tempThreshold = config["temperature_threshold"].toFloat();
-    float humidityThreshold = config["humidity_threshold"].toFloat();
-    
-    // Calculate Heat Index for more realistic "feels like" temperature
-    float feelsLikeTemp = calculateHeatIndex(temperature, humidity);
-    
-    float score = 0.0;
-    
-    // Temperature contribution using Heat Index (feels like temperature)
-    if (feelsLikeTemp > comfortTemperature) {
-        if (feelsLikeTemp > tempThreshold) {
-            // Non-linear increase past threshold - heat becomes exponentially more uncomfortable
-            score += tempWeight * (10 + pow((feelsLikeTemp - tempThreshold), 2));
-        } else {
-            score += tempWeight * (feelsLikeTemp - comfortTemperature);
-        }
-    }
-    
-    // Humidity contribution - high humidity makes it harder to cool down
-    if (humidity > comfortHumidity) {
-        if (humidity > humidityThreshold) {
-            // Non-linear increase for high humidity - sweating becomes less effective
-            score += humidityWeight * (5 + pow((humidity - humidityThreshold), 1.5));
-        } else {
-            score += humidityWeight * (humidity - comfortHumidity);
-        }
-    }
-    
-    // Additional realistic factors
-    
-    // Humidity amplification effect - very high humidity makes any heat much worse
-    if (humidity > 75.0 && temperature > comfortTemperature) {
-        float humidityAmplifier = (humidity - 75.0) / 25.0; // 0 to 1 scale
-        score += tempWeight * (temperature - comfortTemperature) * humidityAmplifier;
-    }
-    
-    // Low humidity relief - dry air feels slightly better even when hot
-    if (humidity < 40.0 && temperature > comfortTemperature) {
-        float dryAirRelief = (40.0 - humidity) / 40.0 * 0.3; // Small relief factor
-        score *= (1.0 - dryAirRelief);
-    }
-    
-    score = truncf(score * 100) / 100;
-    return score;
+    return ScoreCalculator::calculateScore(config, temperature, humidity);
 }
 
 
@@ -549,56 +430,12 @@ void uploadDhtData(float temperature, float humidity, float score,
     }
 }
 
-String urlencode(String str) {
-    String encodedString = "";
-    char c;
-    char code0;
-    char code1;
-    for (unsigned int i = 0; i < str.length(); i++) {
-        c = str.charAt(i);
-        if (c == ' ') {
-            encodedString += '+';
-        } else if (isalnum(c)) {
-            encodedString += c;
-        } else {
-            code1 = (c & 0xf) + '0';
-            if ((c & 0xf) > 9) {
-                code1 = (c & 0xf) - 10 + 'A';
-            }
-            c = (c >> 4) & 0xf;
-            code0 = c + '0';
-            if (c > 9) {
-                code0 = c - 10 + 'A';
-            }
-            encodedString += '%';
-            encodedString += code0;
-            encodedString += code1;
-        }
-        yield();
-    }
-    return encodedString;
-}
-
-unsigned char h2int(char c) {
-    if (c >= '0' && c <= '9') {
-        return ((unsigned char)c - '0');
-    }
-    if (c >= 'a' && c <= 'f') {
-        return ((unsigned char)c - 'a' + 10);
-    }
-    if (c >= 'A' && c <= 'F') {
-        return ((unsigned char)c - 'A' + 10);
-    }
-    return (0);
-}
-
 void logTelegram(String msg) {
     if (wifi.isConnected()) {
         // create an HTTPClient instance
         HTTPClient telegramSendMsgRequest;
-        String url = "https://api.telegram.org/" + String(TELEGRAM_API_KEY) +
-                     "/sendMessage?chat_id=-" + String(TELEGRAM_GROUP_ID) +
-                     "&text=" + urlencode(msg);
+        String url = Telegram::sendMessageUrl(TELEGRAM_API_KEY,
+                                              TELEGRAM_GROUP_ID, msg);
         if (telegramSendMsgRequest.begin(*client.httpClient, url)) {  // HTTPS
             Serial.println("[HTTPS] GETing... " + msg);
             // start connection and send HTTP header
@@ -0,0 +1,33 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+// Host stand-in for the parts of the ESP8266 Arduino core the sources under
+// src/ rely on, so they can be built for the native test environment
+
+#include <ctype.h>
+#include <math.h>
+
+#include <cmath>
+
+#include "WString.h"
+
+using std::abs;
+
+typedef bool boolean;
+
+inline void yield() {}
+
+class NativeSerial {
+public:
+    template <typename T>
+    void print(const T&) {}
+    template <typename T>
+    void println(const T&) {}
+    void println() {}
+    template <typename... Args>
+    void printf(const char*, Args...) {}
+};
+
+static NativeSerial Serial;
+
+#endif
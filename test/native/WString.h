@@ -0,0 +1,261 @@
+#ifndef NATIVE_WSTRING_H
+#define NATIVE_WSTRING_H
+
+// Host stand-in for the Arduino String, used to build the sources under src/
+// for the native test environment. Buffers are managed like the older ESP8266
+// cores (short string buffer of 11 chars, heap buffers sized to the requested
+// length rounded up to 16 bytes, "a" + b + c appending into one
+// StringSumHelper). The allocation counts it gives are host numbers for
+// comparing runs against each other, not the device's: newer cores build
+// sums with rvalue operator+ overloads instead.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <new>
+#include <utility>
+
+class StringSumHelper;
+
+class String {
+public:
+    String(const char* cstr = "") { copy(cstr, cstr ? strlen(cstr) : 0); }
+    String(const String& str) { copy(str.buffer(), str.len); }
+    String(String&& rval) noexcept { move(rval); }
+    explicit String(char c) { copy(&c, 1); }
+    explicit String(int value) { format("%d", value); }
+    explicit String(unsigned int value) { format("%u", value); }
+    explicit String(long value) { format("%ld", value); }
+    explicit String(unsigned long value) { format("%lu", value); }
+    explicit String(float value, unsigned char decimalPlaces = 2) {
+        format("%.*f", decimalPlaces, (double)value);
+    }
+    explicit String(double value, unsigned char decimalPlaces = 2) {
+        format("%.*f", decimalPlaces, value);
+    }
+    ~String() { invalidate(); }
+
+    String& operator=(const String& rhs) {
+        if (this != &rhs) {
+            copy(rhs.buffer(), rhs.len);
+        }
+        return *this;
+    }
+    String& operator=(String&& rval) noexcept {
+        if (this != &rval) {
+            invalidate();
+            move(rval);
+        }
+        return *this;
+    }
+    String& operator=(const char* cstr) {
+        copy(cstr, cstr ? strlen(cstr) : 0);
+        return *this;
+    }
+
+    bool concat(const char* cstr, unsigned int length) {
+        if (length == 0) {
+            return true;
+        }
+        if (!reserve(len + length)) {
+            return false;
+        }
+        memmove(wbuffer() + len, cstr, length);
+        len += length;
+        wbuffer()[len] = 0;
+        return true;
+    }
+    bool concat(const String& str) { return concat(str.buffer(), str.len); }
+    bool concat(const char* cstr) { return concat(cstr, strlen(cstr)); }
+    bool concat(char c) { return concat(&c, 1); }
+
+    String& operator+=(const String& rhs) {
+        concat(rhs);
+        return *this;
+    }
+    String& operator+=(const char* cstr) {
+        concat(cstr);
+        return *this;
+    }
+    String& operator+=(char c) {
+        concat(c);
+        return *this;
+    }
+
+    friend StringSumHelper& operator+(const StringSumHelper& lhs,
+                                      const String& rhs);
+    friend StringSumHelper& operator+(const StringSumHelper& lhs,
+                                      const char* cstr);
+
+    unsigned int length() const { return len; }
+    const char* c_str() const { return buffer(); }
+    char charAt(unsigned int index) const {
+        return index < len ? buffer()[index] : 0;
+    }
+    char operator[](unsigned int index) const { return charAt(index); }
+
+    int compareTo(const String& s) const { return strcmp(buffer(), s.buffer()); }
+    bool equals(const char* cstr) const { return strcmp(buffer(), cstr) == 0; }
+    bool operator==(const String& rhs) const {
+        return len == rhs.len && compareTo(rhs) == 0;
+    }
+    bool operator==(const char* cstr) const { return equals(cstr); }
+    bool operator!=(const String& rhs) const { return !(*this == rhs); }
+    bool operator!=(const char* cstr) const { return !equals(cstr); }
+    bool operator<(const String& rhs) const { return compareTo(rhs) < 0; }
+
+    int indexOf(char ch, unsigned int fromIndex = 0) const {
+        if (fromIndex >= len) {
+            return -1;
+        }
+        const char* found = strchr(buffer() + fromIndex, ch);
+        return found ? (int)(found - buffer()) : -1;
+    }
+
+    String substring(unsigned int beginIndex) const {
+        return substring(beginIndex, len);
+    }
+    String substring(unsigned int left, unsigned int right) const {
+        if (left > right) {
+            std::swap(left, right);
+        }
+        String out;
+        if (left >= len) {
+            return out;
+        }
+        if (right > len) {
+            right = len;
+        }
+        out.copy(buffer() + left, right - left);
+        return out;
+    }
+
+    void replace(const String& find, const String& replace) {
+        if (len == 0 || find.len == 0) {
+            return;
+        }
+        int diff = (int)replace.len - (int)find.len;
+        char* readFrom = wbuffer();
+        char* foundAt;
+        if (diff <= 0) {
+            char* writeTo = wbuffer();
+            while ((foundAt = strstr(readFrom, find.buffer())) != nullptr) {
+                unsigned int n = foundAt - readFrom;
+                memmove(writeTo, readFrom, n);
+                writeTo += n;
+                memmove(writeTo, replace.buffer(), replace.len);
+                writeTo += replace.len;
+                readFrom = foundAt + find.len;
+                len += diff;
+            }
+            memmove(writeTo, readFrom, strlen(readFrom) + 1);
+            return;
+        }
+        String out;
+        while ((foundAt = strstr(readFrom, find.buffer())) != nullptr) {
+            out.concat(readFrom, foundAt - readFrom);
+            out.concat(replace);
+            readFrom = foundAt + find.len;
+        }
+        out.concat(readFrom);
+        *this = std::move(out);
+    }
+
+    long toInt() const { return atol(buffer()); }
+    float toFloat() const { return (float)atof(buffer()); }
+
+    bool reserve(unsigned int size) {
+        if (size <= capacity()) {
+            return true;
+        }
+        // same rounding as the core's changeBuffer()
+        unsigned int newCapacity = ((size + 16) & ~0xf) - 1;
+        char* heap = static_cast<char*>(::operator new(newCapacity + 1));
+        memcpy(heap, buf, len);
+        heap[len] = 0;
+        if (!isSso()) {
+            ::operator delete(buf);
+        }
+        buf = heap;
+        cap = newCapacity;
+        return true;
+    }
+
+private:
+    static const unsigned int SSO_CAPACITY = 11;
+
+    char ssoBuf[SSO_CAPACITY + 1] = {0};
+    char* buf = ssoBuf;
+    unsigned int len = 0;
+    unsigned int cap = SSO_CAPACITY;
+
+    const char* buffer() const { return buf; }
+    char* wbuffer() { return buf; }
+    unsigned int capacity() const { return cap; }
+    bool isSso() const { return buf == ssoBuf; }
+
+    void init() {
+        buf = ssoBuf;
+        len = 0;
+        cap = SSO_CAPACITY;
+        ssoBuf[0] = 0;
+    }
+    void invalidate() {
+        if (!isSso()) {
+            ::operator delete(buf);
+        }
+        init();
+    }
+    void copy(const char* cstr, unsigned int length) {
+        reserve(length);
+        memmove(buf, cstr, length);
+        len = length;
+        buf[len] = 0;
+    }
+    void move(String& rhs) {
+        len = rhs.len;
+        cap = rhs.cap;
+        if (rhs.isSso()) {
+            memcpy(ssoBuf, rhs.ssoBuf, sizeof(ssoBuf));
+            buf = ssoBuf;
+        } else {
+            buf = rhs.buf;
+        }
+        rhs.init();
+    }
+    template <typename T>
+    void format(const char* fmt, int precision, T value) {
+        char digits[64];
+        int n = snprintf(digits, sizeof(digits), fmt, precision, value);
+        copy(digits, n < (int)sizeof(digits) ? n : sizeof(digits) - 1);
+    }
+    template <typename T>
+    void format(const char* fmt, T value) {
+        char digits[32];
+        int n = snprintf(digits, sizeof(digits), fmt, value);
+        copy(digits, n);
+    }
+};
+
+class StringSumHelper : public String {
+public:
+    StringSumHelper(const String& s) : String(s) {}
+    StringSumHelper(const char* p) : String(p) {}
+};
+
+inline StringSumHelper& operator+(const StringSumHelper& lhs,
+                                  const String& rhs) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(rhs);
+    return a;
+}
+
+inline StringSumHelper& operator+(const StringSumHelper& lhs,
+                                  const char* cstr) {
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);
+    a.concat(cstr);
+    return a;
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef BASELINES_H
+#define BASELINES_H
+
+// Recorded results of the benchmarks in test_main.cpp. A run fails when a
+// benchmark needs more allocations or peak heap than recorded here. Each run
+// prints its results in this format; paste them in when a change is meant to
+// move them.
+//
+// ns/op is informational: it was recorded on an x86-64 Linux host and is only
+// checked when the suite is built with -D BENCH_NS_TOLERANCE=<factor>, e.g.
+// PLATFORMIO_BUILD_FLAGS="-D BENCH_NS_TOLERANCE=1.5" pio test -e native -v
+// after re-recording the column on the same machine.
+
+#include <string.h>
+
+struct Baseline {
+    const char* name;
+    double nsPerOp;
+    double allocsPerOp;
+    size_t peakHeap;
+};
+
+const Baseline BASELINES[] = {
+    {"heat_index_mild", 4.0, 0.0, 0},
+    {"heat_index_humid", 16.5, 0.0, 0},
+    {"heat_index_dry", 22.4, 0.0, 0},
+    {"score_mild", 786.8, 6.0, 32},
+    {"score_humid", 855.8, 6.0, 32},
+    {"score_dry", 972.8, 6.0, 32},
+    {"config_parse_realistic", 5768.1, 84.0, 2784},
+    {"config_parse_worst_case", 100694.0, 1284.0, 41328},
+    {"urlencode_realistic", 2151.8, 25.0, 992},
+    {"urlencode_worst_case", 2633219.4, 3074.0, 114720},
+    {"telegram_reading_realistic", 1608.3, 8.0, 256},
+    {"telegram_reading_worst_case", 6899.1, 16.0, 880},
+    {"telegram_url_realistic", 2526.1, 32.0, 1584},
+    {"telegram_url_worst_case", 2559431.4, 3081.0, 164096},
+};
+
+inline const Baseline* findBaseline(const char* name) {
+    for (const Baseline& baseline : BASELINES) {
+        if (strcmp(baseline.name, name) == 0) {
+            return &baseline;
+        }
+    }
+    return nullptr;
+}
+
+#endif
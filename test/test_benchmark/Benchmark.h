@@ -0,0 +1,115 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// Micro-benchmark harness for the native environment. Every heap allocation
+// made through operator new (Arduino String buffers, std::map nodes) is
+// counted, so each benchmark reports ns/op, allocations/op and the peak heap
+// a single call needs on top of what was live before it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <cstddef>
+#include <new>
+
+namespace heap {
+
+unsigned long allocations = 0;
+size_t live = 0;
+size_t peak = 0;
+
+// Each block carries its size in front of the user pointer so frees can be
+// subtracted from the live total
+const size_t HEADER = alignof(std::max_align_t);
+
+void* allocate(size_t size) {
+    char* block = static_cast<char*>(malloc(size + HEADER));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<size_t*>(block) = size;
+    allocations++;
+    live += size;
+    if (live > peak) {
+        peak = live;
+    }
+    return block + HEADER;
+}
+
+void release(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    char* block = static_cast<char*>(ptr) - HEADER;
+    live -= *reinterpret_cast<size_t*>(block);
+    free(block);
+}
+
+}  // namespace heap
+
+void* operator new(size_t size) { return heap::allocate(size); }
+void* operator new[](size_t size) { return heap::allocate(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return heap::allocate(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+void operator delete(void* ptr) noexcept { heap::release(ptr); }
+void operator delete[](void* ptr) noexcept { heap::release(ptr); }
+void operator delete(void* ptr, size_t) noexcept { heap::release(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { heap::release(ptr); }
+
+struct BenchResult {
+    double nsPerOp;
+    double allocsPerOp;
+    size_t peakHeap;
+};
+
+// Keeps results observable so the compiler can't drop the measured call
+volatile float floatSink;
+volatile unsigned int lengthSink;
+
+const int BENCH_ROUNDS = 5;
+
+// Runs fn() `iterations` times per round and keeps the fastest round
+template <typename Fn>
+BenchResult runBenchmark(const char* name, unsigned long iterations, Fn fn) {
+    BenchResult result;
+    fn();  // warm up
+
+    size_t liveBefore = heap::live;
+    heap::peak = heap::live;
+    fn();
+    result.peakHeap = heap::peak - liveBefore;
+
+    unsigned long allocationsBefore = heap::allocations;
+    double bestNs = -1;
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned long i = 0; i < iterations; i++) {
+            fn();
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        if (bestNs < 0 || ns < bestNs) {
+            bestNs = ns;
+        }
+    }
+    result.nsPerOp = bestNs / iterations;
+    result.allocsPerOp = (double)(heap::allocations - allocationsBefore) /
+                         (iterations * BENCH_ROUNDS);
+
+    // Same shape as a Baselines.h row, so new numbers can be pasted in
+    printf("    {\"%s\", %.1f, %.1f, %zu},\n", name, result.nsPerOp,
+           result.allocsPerOp, result.peakHeap);
+    return result;
+}
+
+#endif
@@ -0,0 +1,270 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <ConfigParser.cpp>
+#include <ScoreCalculator.cpp>
+#include <Telegram.cpp>
+#include <map>
+
+#include "Baselines.h"
+#include "Benchmark.h"
+
+// Longest message Telegram accepts, in characters. logTelegram() doesn't cap
+// what it sends, so this sizes the worst case rather than bounding it.
+const unsigned int TELEGRAM_MAX_MESSAGE_CHARACTERS = 4096;
+
+// Values as they come from the config sheet
+const char* REALISTIC_CONFIG_CSV =
+    "\"should_skip\",\"FALSE\"\n"
+    "\"is_work_hours_enabled\",\"FALSE\"\n"
+    "\"work_hour_start\",\"9\"\n"
+    "\"work_hour_end\",\"18\"\n"
+    "\"mode\",\"ON_OFF\"\n"
+    "\"max_already_warning_count\",\"3\"\n"
+    "\"force_mode\",\"FALSE\"\n"
+    "\"sunrise_hour\",\"6\"\n"
+    "\"sunset_hour\",\"18\"\n"
+    "\"ac_on_score_day\",\"4.5\"\n"
+    "\"ac_off_score_day\",\"1.5\"\n"
+    "\"ac_on_score_night\",\"3.5\"\n"
+    "\"ac_off_score_night\",\"0.5\"\n"
+    "\"comfort_temperature\",\"26\"\n"
+    "\"comfort_humidity\",\"55\"\n"
+    "\"temperature_weight\",\"1\"\n"
+    "\"humidity_weight\",\"0.1\"\n"
+    "\"temperature_threshold\",\"30\"\n"
+    "\"humidity_threshold\",\"70\"\n"
+    "\"hands_down_angle\",\"0\"\n"
+    "\"hands_up_angle\",\"180\"\n"
+    "\"up_down_delay_in_ms\",\"200\"\n"
+    "\"sleep_time_in_minutes\",\"5\"";
+
+String realisticConfigCsv;
+String worstCaseConfigCsv;
+std::map<String, String> config;
+String realisticReport;
+String worstCaseReport;
+
+void setUp() {}
+
+void tearDown() {}
+
+void checkBaseline(const char* name, const BenchResult& result) {
+    const Baseline* baseline = findBaseline(name);
+    char message[160];
+    snprintf(message, sizeof(message), "%s has no entry in Baselines.h", name);
+    TEST_ASSERT_NOT_NULL_MESSAGE(baseline, message);
+
+    snprintf(message, sizeof(message), "%s: %.1f allocations/op, baseline %.1f",
+             name, result.allocsPerOp, baseline->allocsPerOp);
+    TEST_ASSERT_TRUE_MESSAGE(result.allocsPerOp <= baseline->allocsPerOp,
+                             message);
+
+    snprintf(message, sizeof(message), "%s: %zu bytes peak heap, baseline %zu",
+             name, result.peakHeap, baseline->peakHeap);
+    TEST_ASSERT_TRUE_MESSAGE(result.peakHeap <= baseline->peakHeap, message);
+
+    // Timings only mean something on the host they were recorded on, so the
+    // ns/op gate is opted into with -D BENCH_NS_TOLERANCE=<allowed slowdown>
+#ifdef BENCH_NS_TOLERANCE
+    snprintf(message, sizeof(message), "%s: %.1f ns/op, baseline %.1f", name,
+             result.nsPerOp, baseline->nsPerOp);
+    TEST_ASSERT_TRUE_MESSAGE(
+        result.nsPerOp <= baseline->nsPerOp * BENCH_NS_TOLERANCE, message);
+#endif
+}
+
+// Readings are volatile so the float math isn't folded at compile time
+volatile float mildTemperature = 24.0;
+volatile float mildHumidity = 50.0;
+volatile float humidTemperature = 31.5;
+volatile float humidHumidity = 92.0;
+volatile float dryTemperature = 40.0;
+volatile float dryHumidity = 10.0;
+
+void test_heat_index_mild() {
+    const char* name = "heat_index_mild";
+    checkBaseline(name, runBenchmark(name, 1000000, [] {
+        floatSink = ScoreCalculator::calculateHeatIndex(mildTemperature,
+                                                        mildHumidity);
+    }));
+}
+
+void test_heat_index_humid() {
+    const char* name = "heat_index_humid";
+    checkBaseline(name, runBenchmark(name, 1000000, [] {
+        floatSink = ScoreCalculator::calculateHeatIndex(humidTemperature,
+                                                        humidHumidity);
+    }));
+}
+
+void test_heat_index_dry() {
+    const char* name = "heat_index_dry";
+    checkBaseline(name, runBenchmark(name, 1000000, [] {
+        floatSink = ScoreCalculator::calculateHeatIndex(dryTemperature,
+                                                        dryHumidity);
+    }));
+}
+
+void test_score_mild() {
+    const char* name = "score_mild";
+    checkBaseline(name, runBenchmark(name, 100000, [] {
+        floatSink = ScoreCalculator::calculateScore(config, mildTemperature,
+                                                    mildHumidity);
+    }));
+}
+
+// Past both thresholds with the humidity amplifier on: every branch that
+// adds to the score is taken
+void test_score_humid() {
+    const char* name = "score_humid";
+    checkBaseline(name, runBenchmark(name, 100000, [] {
+        floatSink = ScoreCalculator::calculateScore(config, humidTemperature,
+                                                    humidHumidity);
+    }));
+}
+
+void test_score_dry() {
+    const char* name = "score_dry";
+    checkBaseline(name, runBenchmark(name, 100000, [] {
+        floatSink = ScoreCalculator::calculateScore(config, dryTemperature,
+                                                    dryHumidity);
+    }));
+}
+
+void test_config_parse_realistic() {
+    const char* name = "config_parse_realistic";
+    checkBaseline(name, runBenchmark(name, 10000, [] {
+        lengthSink = ConfigParser::parse(realisticConfigCsv).size();
+    }));
+}
+
+void test_config_parse_worst_case() {
+    const char* name = "config_parse_worst_case";
+    checkBaseline(name, runBenchmark(name, 200, [] {
+        lengthSink = ConfigParser::parse(worstCaseConfigCsv).size();
+    }));
+}
+
+void test_urlencode_realistic() {
+    const char* name = "urlencode_realistic";
+    checkBaseline(name, runBenchmark(name, 10000, [] {
+        lengthSink = Telegram::urlencode(realisticReport).length();
+    }));
+}
+
+// Every byte is escaped, so the output is three times the input
+void test_urlencode_worst_case() {
+    const char* name = "urlencode_worst_case";
+    checkBaseline(name, runBenchmark(name, 250, [] {
+        lengthSink = Telegram::urlencode(worstCaseReport).length();
+    }));
+}
+
+void test_telegram_reading_realistic() {
+    const char* name = "telegram_reading_realistic";
+    checkBaseline(name, runBenchmark(name, 100000, [] {
+        lengthSink = Telegram::reading(humidTemperature, humidHumidity, 4.73,
+                                       4.5, 1.5)
+                         .length();
+    }));
+}
+
+// Largest floats print the longest numbers
+void test_telegram_reading_worst_case() {
+    const char* name = "telegram_reading_worst_case";
+    checkBaseline(name, runBenchmark(name, 100000, [] {
+        lengthSink = Telegram::reading(-3.4e38, -3.4e38, -3.4e38, -3.4e38,
+                                       -3.4e38)
+                         .length();
+    }));
+}
+
+void test_telegram_url_realistic() {
+    const char* name = "telegram_url_realistic";
+    checkBaseline(name, runBenchmark(name, 10000, [] {
+        lengthSink = Telegram::sendMessageUrl("bot0000000000:KEY", "1000000000",
+                                              realisticReport)
+                         .length();
+    }));
+}
+
+void test_telegram_url_worst_case() {
+    const char* name = "telegram_url_worst_case";
+    checkBaseline(name, runBenchmark(name, 250, [] {
+        lengthSink = Telegram::sendMessageUrl("bot0000000000:KEY", "1000000000",
+                                              worstCaseReport)
+                         .length();
+    }));
+}
+
+// Builds the benchmark inputs and checks the code under test still gives the
+// expected results, so a benchmark can't pass while measuring broken code
+void test_prepare_inputs() {
+    realisticConfigCsv = REALISTIC_CONFIG_CSV;
+    config = ConfigParser::parse(realisticConfigCsv);
+    TEST_ASSERT_EQUAL_UINT(23, config.size());
+    TEST_ASSERT_EQUAL_STRING("26", config["comfort_temperature"].c_str());
+    TEST_ASSERT_EQUAL_STRING("ON_OFF", config["mode"].c_str());
+    TEST_ASSERT_EQUAL_STRING("5", config["sleep_time_in_minutes"].c_str());
+
+    TEST_ASSERT_EQUAL_FLOAT(24.0, ScoreCalculator::calculateHeatIndex(24, 50));
+    TEST_ASSERT_EQUAL_FLOAT(0.0,
+                            ScoreCalculator::calculateScore(config, 24, 50));
+    TEST_ASSERT_EQUAL_FLOAT(337.22,
+                            ScoreCalculator::calculateScore(config, 31.5, 92));
+    TEST_ASSERT_EQUAL_FLOAT(42.59,
+                            ScoreCalculator::calculateScore(config, 40, 10));
+
+    TEST_ASSERT_EQUAL_STRING("a+b%2F", Telegram::urlencode("a b/").c_str());
+    TEST_ASSERT_EQUAL_STRING(
+        "https://api.telegram.org/key/sendMessage?chat_id=-42&text=a+b%2F",
+        Telegram::sendMessageUrl("key", "42", "a b/").c_str());
+
+    // A sheet that grew well past what the firmware reads, with long values
+    worstCaseConfigCsv = REALISTIC_CONFIG_CSV;
+    for (int i = 0; i < 200; i++) {
+        worstCaseConfigCsv += "\n\"unused_key_with_a_long_name_" + String(i) +
+                              "\",\"" +
+                              "a value long enough to force heap buffers " +
+                              "for every substring\"";
+    }
+    TEST_ASSERT_EQUAL_UINT(223, ConfigParser::parse(worstCaseConfigCsv).size());
+
+    // What a busy loop() iteration sends
+    realisticReport = "\n🌞 Day time: Hour@14";
+    realisticReport += Telegram::reading(31.5, 92.0, 4.73, 4.5, 1.5);
+    realisticReport += "\n\n🟢 AC is already on!";
+    realisticReport += "\n Points to turn off " + String(-3.23f) + " more!";
+    realisticReport += "\n\n 😴Sleeping for " + String(5) + " minutes...";
+
+    // Four byte emoji, about 16 KB
+    for (unsigned int i = 0; i < TELEGRAM_MAX_MESSAGE_CHARACTERS; i++) {
+        worstCaseReport += "🥵";
+    }
+    TEST_ASSERT_EQUAL_UINT(TELEGRAM_MAX_MESSAGE_CHARACTERS * 4,
+                           worstCaseReport.length());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_prepare_inputs);
+    if (Unity.TestFailures > 0) {
+        return UNITY_END();
+    }
+    RUN_TEST(test_heat_index_mild);
+    RUN_TEST(test_heat_index_humid);
+    RUN_TEST(test_heat_index_dry);
+    RUN_TEST(test_score_mild);
+    RUN_TEST(test_score_humid);
+    RUN_TEST(test_score_dry);
+    RUN_TEST(test_config_parse_realistic);
+    RUN_TEST(test_config_parse_worst_case);
+    RUN_TEST(test_urlencode_realistic);
+    RUN_TEST(test_urlencode_worst_case);
+    RUN_TEST(test_telegram_reading_realistic);
+    RUN_TEST(test_telegram_reading_worst_case);
+    RUN_TEST(test_telegram_url_realistic);
+    RUN_TEST(test_telegram_url_worst_case);
+    return UNITY_END();
+}